@@ -0,0 +1,98 @@
+#include "Board.h"
+
+namespace {
+    Winner markToWinner(Mark mark) {
+        Winner returnValue = Winner::NONE;
+        switch (mark) {
+            case Mark::X:
+                returnValue = Winner::X;
+                break;
+            case Mark::O:
+                returnValue = Winner::O;
+                break;
+            case Mark::EMPTY:
+                returnValue = Winner::NONE;
+                break;
+        }
+        return returnValue;
+    }
+
+    /* Checks if three cells are the same and not empty. */
+    bool checkLine(Mark a, Mark b, Mark c) {
+        return (a == b && b == c && a != Mark::EMPTY);
+    }
+
+    Winner checkRows(const Board &board) {
+        for (const auto &row: board) {
+            if (checkLine(row[COL_1], row[COL_2], row[COL_3])) {
+                return markToWinner(row[COL_1]);
+            }
+        }
+        return Winner::NONE;
+    }
+
+    Winner checkColumns(const Board &board) {
+        for (int col = COL_1; col < numColumns; ++col) {
+            if (checkLine(board[ROW_1][col], board[ROW_2][col], board[ROW_3][col])) {
+                return markToWinner(board[ROW_1][col]);
+            }
+        }
+        return Winner::NONE;
+    }
+
+    Winner checkDiagonals(const Board &board) {
+        if (checkLine(board[ROW_1][COL_1], board[ROW_2][COL_2], board[ROW_3][COL_3])) {
+            return markToWinner(board[ROW_1][COL_1]);
+        }
+        if (checkLine(board[ROW_1][COL_3], board[ROW_2][COL_2], board[ROW_3][COL_1])) {
+            return markToWinner(board[ROW_1][COL_3]);
+        }
+        return Winner::NONE;
+    }
+}// namespace
+
+std::optional<Board> parseBoard(std::string_view cells) {
+    if (cells.size() != numRows * numColumns) {
+        return std::nullopt;
+    }
+    Board board{};
+    for (int row = ROW_1; row < numRows; ++row) {
+        for (int col = COL_1; col < numColumns; ++col) {
+            switch (cells[row * numColumns + col]) {
+                case 'X':
+                    board[row][col] = Mark::X;
+                    break;
+                case 'O':
+                    board[row][col] = Mark::O;
+                    break;
+                case '.':
+                case '-':
+                case ' ':
+                    board[row][col] = Mark::EMPTY;
+                    break;
+                default:
+                    return std::nullopt;
+            }
+        }
+    }
+    return board;
+}
+
+Winner checkWinCondition(const Board &board, int turnNumber) {
+    Winner winner = checkRows(board);
+    if (winner != Winner::NONE) {
+        return winner;
+    }
+    winner = checkColumns(board);
+    if (winner != Winner::NONE) {
+        return winner;
+    }
+    winner = checkDiagonals(board);
+    if (winner != Winner::NONE) {
+        return winner;
+    }
+    if (turnNumber == MAX_TURNS) {
+        return Winner::DRAW;
+    }
+    return winner;
+}
@@ -0,0 +1,105 @@
+#ifndef NOUGHTS_AND_CROSSES_BOARD_H
+#define NOUGHTS_AND_CROSSES_BOARD_H
+
+#include <array>
+#include <optional>
+#include <string_view>
+
+/**
+ * @brief The number of rows on the game board.
+ *
+ * This constant defines the number of rows present on the game board. It is used to determine the
+ * vertical dimension of the board.
+ */
+constexpr int numRows = 3;
+/**
+ * @brief The number of columns on the game board.
+ *
+ * This constant defines the number of columns present on the game board. It is used to determine the
+ * horizontal dimension of the board.
+ */
+constexpr int numColumns = 3;
+
+/**
+ * @brief Index of the first row (0-based index).
+ */
+constexpr int ROW_1 = 0;
+/**
+ * @brief Index of the second row (1-based index).
+ */
+constexpr int ROW_2 = 1;
+/**
+ * @brief Index of the third row (2-based index).
+ */
+constexpr int ROW_3 = 2;
+
+/**
+ * @brief Index of the first column (0-based index).
+ */
+constexpr int COL_1 = 0;
+/**
+ * @brief Index of the second column (1-based index).
+ */
+constexpr int COL_2 = 1;
+/**
+ * @brief Index of the third column (2-based index).
+ */
+constexpr int COL_3 = 2;
+
+/**
+ * @brief The minimum number of turns required before checking for a winning condition.
+ *
+ * This helps to optimize the game by not checking for a win until it's possible.
+ */
+constexpr int WINNING_TURN_THRESHOLD = 4;
+/**
+ * @brief The maximum number of turns in the game, representing a full board without a winner.
+ */
+constexpr int MAX_TURNS = numRows * numColumns;
+
+/**
+ * @brief Enum representing the state of a cell on the game board.
+ *
+ * This enum is used to mark each cell on the board with either X, O, or as EMPTY.
+ */
+enum class Mark {
+    X = 'X',    /**< Cell is marked by Player X. */
+    O = 'O',    /**< Cell is marked by Player O. */
+    EMPTY = ' ' /**< Cell is empty and unmarked. */
+};
+
+/**
+ * @brief Enum representing the winner of the game.
+ *
+ * This enum is used to indicate the final outcome of the game.
+ */
+enum class Winner {
+    X = 'X',    /**< Player X has won the game. */
+    O = 'O',    /**< Player O has won the game. */
+    DRAW = 'D', /**< The game ended in a draw. */
+    NONE = ' '  /**< The game is still ongoing or no winner has been determined. */
+};
+
+/**
+ * @brief The cells of a game board, indexed as board[row][col].
+ */
+using Board = std::array<std::array<Mark, numRows>, numColumns>;
+
+/**
+ * @brief Parses a board from its cells in row-major order.
+ *
+ * 'X' and 'O' mark a cell, '.', '-' and ' ' leave it empty, e.g. "XO..X...O".
+ * @param cells The characters of the board.
+ * @return The parsed board, or std::nullopt if the text is not a valid board.
+ */
+std::optional<Board> parseBoard(std::string_view cells);
+
+/**
+ * @brief Checks the win condition for a board.
+ * @param board The board to check.
+ * @param turnNumber The number of marks placed on the board.
+ * @return The winner enum of the winning player, draw if the board is full, none otherwise.
+ */
+Winner checkWinCondition(const Board &board, int turnNumber);
+
+#endif//NOUGHTS_AND_CROSSES_BOARD_H
@@ -0,0 +1,128 @@
+#include "BoardRenderer.h"
+
+namespace {
+    void appendRectangle(std::vector<sf::Vertex> &vertices, const sf::RectangleShape &rectangle) {
+        const sf::Transform &transform = rectangle.getTransform();
+        std::array<sf::Vector2f, 4> corners{};
+        for (std::size_t i = 0; i < corners.size(); ++i) {
+            corners[i] = transform.transformPoint(rectangle.getPoint(i));
+        }
+        for (std::size_t i: {0, 1, 2, 0, 2, 3}) {
+            vertices.emplace_back(corners[i], rectangle.getFillColor());
+        }
+    }
+
+    /* The outline of a shape is drawn outside of its points; for a circle that is a ring of the given thickness. */
+    void appendCircleOutline(std::vector<sf::Vertex> &vertices, const sf::CircleShape &circle) {
+        const sf::Transform &transform = circle.getTransform();
+        float radius = circle.getRadius();
+        float outerScale = (radius + circle.getOutlineThickness()) / radius;
+        sf::Vector2f center(radius, radius);
+        std::size_t count = circle.getPointCount();
+        for (std::size_t i = 0; i < count; ++i) {
+            sf::Vector2f point = circle.getPoint(i);
+            sf::Vector2f next = circle.getPoint((i + 1) % count);
+            sf::Vector2f inner = transform.transformPoint(point);
+            sf::Vector2f innerNext = transform.transformPoint(next);
+            sf::Vector2f outer = transform.transformPoint(center + (point - center) * outerScale);
+            sf::Vector2f outerNext = transform.transformPoint(center + (next - center) * outerScale);
+            for (const auto &corner: {inner, outer, outerNext, inner, outerNext, innerNext}) {
+                vertices.emplace_back(corner, circle.getOutlineColor());
+            }
+        }
+    }
+}// namespace
+
+BoardRenderer::BoardRenderer() {
+    setupGrid();
+    setupShapes();
+    buildGeometry();
+}
+
+void BoardRenderer::setupGrid() {
+    constexpr std::size_t verticalLines = numColumns - 1;
+    // vertical grid lines
+    for (std::size_t i = 0; i < verticalLines; ++i) {
+        grid[i].setFillColor(sf::Color(47, 79, 79));// 64
+        grid[i].setSize(sf::Vector2f(10.f, BOARD_HEIGHT));
+        grid[i].setPosition(CELL_SIZE * ((float) i + 1) - 5, 0.f);
+    }
+    // horizontal grid lines
+    for (std::size_t i = verticalLines; i < grid.size(); ++i) {
+        grid[i].setFillColor(sf::Color(47, 79, 79));// 64
+        grid[i].setSize(sf::Vector2f(BOARD_WIDTH, 10.f));
+        grid[i].setPosition(0.f, CELL_SIZE * ((float) (i - verticalLines) + 1) - 5);
+    }
+}
+
+void BoardRenderer::setupShapes() {
+    oShape.setRadius(75.f);
+    oShape.setFillColor(sf::Color::Transparent);
+    oShape.setOutlineColor(sf::Color(192, 192, 192));// Dark Blue - 0.0.139
+    oShape.setOutlineThickness(10.f);
+    for (auto &i: xShape) {
+        i.setSize(sf::Vector2f(160.f, 10.f));
+        i.setFillColor(sf::Color(192, 192, 192));//Black
+        i.setOrigin(80.f, 5.f);
+    }
+    xShape[0].setRotation(45.f);
+    xShape[1].setRotation(135.f);
+}
+
+void BoardRenderer::buildGeometry() {
+    gridVertices.clear();
+    for (const auto &line: grid) {
+        appendRectangle(gridVertices, line);
+    }
+    xVertices.clear();
+    for (auto &line: xShape) {
+        line.setPosition(CELL_SIZE / 2, CELL_SIZE / 2);
+        appendRectangle(xVertices, line);
+    }
+    oVertices.clear();
+    oShape.setPosition(25.f, 25.f);
+    appendCircleOutline(oVertices, oShape);
+}
+
+void BoardRenderer::draw(sf::RenderTarget &target, const Board &board, const sf::Transform &transform) {
+    sf::RenderStates states(transform);
+    for (const auto &line: grid) {
+        target.draw(line, states);
+    }
+    // Draw shapes on the board
+    for (int row = ROW_1; row < numRows; ++row) {
+        for (int col = COL_1; col < numColumns; ++col) {
+            if (board[row][col] == Mark::X) {
+                xShape[0].setPosition((float) col * CELL_SIZE + CELL_SIZE / 2, (float) row * CELL_SIZE + CELL_SIZE / 2);
+                xShape[1].setPosition((float) col * CELL_SIZE + CELL_SIZE / 2, (float) row * CELL_SIZE + CELL_SIZE / 2);
+                target.draw(xShape.at(0), states);
+                target.draw(xShape.at(1), states);
+            } else if (board[row][col] == Mark::O) {
+                oShape.setPosition((float) col * CELL_SIZE + 25.f, (float) row * CELL_SIZE + 25.f);
+                target.draw(oShape, states);
+            }
+        }
+    }
+}
+
+void BoardRenderer::appendBoard(sf::VertexArray &vertices, const Board &board, const sf::Transform &transform) const {
+    for (const auto &vertex: gridVertices) {
+        vertices.append(sf::Vertex(transform.transformPoint(vertex.position), vertex.color));
+    }
+    for (int row = ROW_1; row < numRows; ++row) {
+        for (int col = COL_1; col < numColumns; ++col) {
+            const std::vector<sf::Vertex> *mark = nullptr;
+            if (board[row][col] == Mark::X) {
+                mark = &xVertices;
+            } else if (board[row][col] == Mark::O) {
+                mark = &oVertices;
+            } else {
+                continue;
+            }
+            sf::Vector2f cellOrigin((float) col * CELL_SIZE, (float) row * CELL_SIZE);
+            for (const auto &vertex: *mark) {
+                vertices.append(sf::Vertex(transform.transformPoint(cellOrigin + vertex.position), vertex.color));
+            }
+        }
+    }
+}
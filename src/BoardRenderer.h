@@ -0,0 +1,62 @@
+#ifndef NOUGHTS_AND_CROSSES_BOARDRENDERER_H
+#define NOUGHTS_AND_CROSSES_BOARDRENDERER_H
+
+#include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include "Board.h"
+#include "Layout.h"
+#include <array>
+#include <vector>
+
+/**
+ * @brief Draws the grid and the 'X' and 'O' marks of a board.
+ *
+ * The shapes are set up in design units, see Layout. Besides drawing the shapes directly, the renderer
+ * can append the same visuals as triangles to a vertex array, so many boards can be drawn with a single
+ * draw call.
+ */
+class BoardRenderer {
+    /**
+     * @brief Sets up the grid lines.
+     */
+    void setupGrid();
+    /**
+     * @brief Sets up the shapes for 'X' and 'O'.
+     */
+    void setupShapes();
+    /**
+     * @brief Converts the grid and shapes to triangles used by appendBoard.
+     */
+    void buildGeometry();
+
+    std::array<sf::RectangleShape, numRows + numColumns - 2> grid;
+    sf::CircleShape oShape;
+    std::array<sf::RectangleShape, 2> xShape;
+    std::vector<sf::Vertex> gridVertices;
+    std::vector<sf::Vertex> xVertices; /* relative to the top left corner of the cell */
+    std::vector<sf::Vertex> oVertices; /* relative to the top left corner of the cell */
+
+public:
+    /**
+     * @brief Constructs a BoardRenderer and sets up the shapes.
+     */
+    BoardRenderer();
+    /**
+     * @brief Draws the grid and the marks of a board.
+     * @param target The target to draw to.
+     * @param board The board to draw.
+     * @param transform The transform from board coordinates to target coordinates.
+     */
+    void draw(sf::RenderTarget &target, const Board &board, const sf::Transform &transform);
+    /**
+     * @brief Appends the grid and the marks of a board as triangles.
+     * @param vertices The vertex array to append to, using the sf::Triangles primitive type.
+     * @param board The board to append.
+     * @param transform The transform from board coordinates to target coordinates.
+     */
+    void appendBoard(sf::VertexArray &vertices, const Board &board, const sf::Transform &transform) const;
+};
+
+#endif//NOUGHTS_AND_CROSSES_BOARDRENDERER_H
@@ -0,0 +1,18 @@
+#include "CommandLine.h"
+
+std::optional<unsigned> parseNumber(std::string_view text) {
+    if (text.empty()) {
+        return std::nullopt;
+    }
+    unsigned value = 0;
+    for (char c: text) {
+        if (c < '0' || c > '9') {
+            return std::nullopt;
+        }
+        value = value * 10 + static_cast<unsigned>(c - '0');
+        if (value > MAX_COMMAND_LINE_NUMBER) {
+            return std::nullopt;
+        }
+    }
+    return value;
+}
@@ -0,0 +1,19 @@
+#ifndef NOUGHTS_AND_CROSSES_COMMANDLINE_H
+#define NOUGHTS_AND_CROSSES_COMMANDLINE_H
+
+#include <optional>
+#include <string_view>
+
+/**
+ * @brief The largest number accepted on the command line.
+ */
+constexpr unsigned MAX_COMMAND_LINE_NUMBER = 999'999;
+
+/**
+ * @brief Parses a non-negative number given on the command line.
+ * @param text The digits of the number, without sign or whitespace.
+ * @return The number, or std::nullopt if the text is empty, not a number or above MAX_COMMAND_LINE_NUMBER.
+ */
+std::optional<unsigned> parseNumber(std::string_view text);
+
+#endif//NOUGHTS_AND_CROSSES_COMMANDLINE_H
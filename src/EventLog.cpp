@@ -0,0 +1,176 @@
+#include "EventLog.h"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+namespace {
+    constexpr std::array<char, 4> LOG_MAGIC = {'N', 'C', 'E', 'V'};
+    constexpr std::uint8_t LOG_VERSION = 1;
+
+    /* Integers are stored little-endian so logs can be shared between machines. */
+    template<typename T>
+    void writeValue(std::ofstream &out, T value) {
+        auto bits = static_cast<std::uint64_t>(value);
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            out.put(static_cast<char>((bits >> (8 * i)) & 0xFF));
+        }
+    }
+
+    template<typename T>
+    T readValue(std::ifstream &in) {
+        std::uint64_t bits = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            int byte = in.get();
+            if (byte == std::char_traits<char>::eof()) {
+                throw std::runtime_error("Error loading event log: Unexpected end of file.");
+            }
+            bits |= static_cast<std::uint64_t>(byte) << (8 * i);
+        }
+        return static_cast<T>(bits);
+    }
+
+    void writeBool(std::ofstream &out, bool value) {
+        writeValue<std::uint8_t>(out, value ? 1 : 0);
+    }
+
+    bool readBool(std::ifstream &in) {
+        return readValue<std::uint8_t>(in) != 0;
+    }
+
+    bool isRecorded(sf::Event::EventType type) {
+        switch (type) {
+            case sf::Event::Closed:
+            case sf::Event::Resized:
+            case sf::Event::LostFocus:
+            case sf::Event::GainedFocus:
+            case sf::Event::TextEntered:
+            case sf::Event::KeyPressed:
+            case sf::Event::KeyReleased:
+            case sf::Event::MouseWheelScrolled:
+            case sf::Event::MouseButtonPressed:
+            case sf::Event::MouseButtonReleased:
+            case sf::Event::MouseMoved:
+            case sf::Event::MouseEntered:
+            case sf::Event::MouseLeft:
+                return true;
+            default:
+                return false;
+        }
+    }
+}// namespace
+
+EventRecorder::EventRecorder(const std::string &path) : out(path, std::ios::binary | std::ios::trunc) {
+    if (!out) {
+        throw std::runtime_error("Error opening event log: Cannot write to " + path + ".");
+    }
+    out.write(LOG_MAGIC.data(), LOG_MAGIC.size());
+    writeValue(out, LOG_VERSION);
+    out.flush();
+    clock.restart();
+}
+
+void EventRecorder::record(const sf::Event &event) {
+    if (!isRecorded(event.type)) {
+        return;
+    }
+    writeValue<std::int64_t>(out, clock.getElapsedTime().asMicroseconds());
+    writeValue<std::uint8_t>(out, event.type);
+    switch (event.type) {
+        case sf::Event::Resized:
+            writeValue<std::uint32_t>(out, event.size.width);
+            writeValue<std::uint32_t>(out, event.size.height);
+            break;
+        case sf::Event::TextEntered:
+            writeValue<std::uint32_t>(out, event.text.unicode);
+            break;
+        case sf::Event::KeyPressed:
+        case sf::Event::KeyReleased:
+            writeValue<std::int32_t>(out, event.key.code);
+            writeBool(out, event.key.alt);
+            writeBool(out, event.key.control);
+            writeBool(out, event.key.shift);
+            writeBool(out, event.key.system);
+            break;
+        case sf::Event::MouseWheelScrolled:
+            writeValue<std::uint8_t>(out, event.mouseWheelScroll.wheel);
+            writeValue<std::uint32_t>(out, std::bit_cast<std::uint32_t>(event.mouseWheelScroll.delta));
+            writeValue<std::int32_t>(out, event.mouseWheelScroll.x);
+            writeValue<std::int32_t>(out, event.mouseWheelScroll.y);
+            break;
+        case sf::Event::MouseButtonPressed:
+        case sf::Event::MouseButtonReleased:
+            writeValue<std::uint8_t>(out, event.mouseButton.button);
+            writeValue<std::int32_t>(out, event.mouseButton.x);
+            writeValue<std::int32_t>(out, event.mouseButton.y);
+            break;
+        case sf::Event::MouseMoved:
+            writeValue<std::int32_t>(out, event.mouseMove.x);
+            writeValue<std::int32_t>(out, event.mouseMove.y);
+            break;
+        default: /* Events without payload */
+            break;
+    }
+    out.flush();
+}
+
+std::vector<RecordedEvent> loadEventLog(const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Error loading event log: Cannot open " + path + ".");
+    }
+    std::array<char, 4> magic{};
+    in.read(magic.data(), magic.size());
+    if (!in || magic != LOG_MAGIC || readValue<std::uint8_t>(in) != LOG_VERSION) {
+        throw std::runtime_error("Error loading event log: " + path + " is not a supported event log.");
+    }
+
+    std::vector<RecordedEvent> events;
+    while (in.peek() != std::char_traits<char>::eof()) {
+        RecordedEvent recorded{};
+        recorded.timestamp = readValue<std::int64_t>(in);
+        auto type = static_cast<sf::Event::EventType>(readValue<std::uint8_t>(in));
+        if (!isRecorded(type)) {
+            throw std::runtime_error("Error loading event log: Unknown event type in " + path + ".");
+        }
+        sf::Event &event = recorded.event;
+        event.type = type;
+        switch (type) {
+            case sf::Event::Resized:
+                event.size.width = readValue<std::uint32_t>(in);
+                event.size.height = readValue<std::uint32_t>(in);
+                break;
+            case sf::Event::TextEntered:
+                event.text.unicode = readValue<std::uint32_t>(in);
+                break;
+            case sf::Event::KeyPressed:
+            case sf::Event::KeyReleased:
+                event.key.code = static_cast<sf::Keyboard::Key>(readValue<std::int32_t>(in));
+                event.key.alt = readBool(in);
+                event.key.control = readBool(in);
+                event.key.shift = readBool(in);
+                event.key.system = readBool(in);
+                break;
+            case sf::Event::MouseWheelScrolled:
+                event.mouseWheelScroll.wheel = static_cast<sf::Mouse::Wheel>(readValue<std::uint8_t>(in));
+                event.mouseWheelScroll.delta = std::bit_cast<float>(readValue<std::uint32_t>(in));
+                event.mouseWheelScroll.x = readValue<std::int32_t>(in);
+                event.mouseWheelScroll.y = readValue<std::int32_t>(in);
+                break;
+            case sf::Event::MouseButtonPressed:
+            case sf::Event::MouseButtonReleased:
+                event.mouseButton.button = static_cast<sf::Mouse::Button>(readValue<std::uint8_t>(in));
+                event.mouseButton.x = readValue<std::int32_t>(in);
+                event.mouseButton.y = readValue<std::int32_t>(in);
+                break;
+            case sf::Event::MouseMoved:
+                event.mouseMove.x = readValue<std::int32_t>(in);
+                event.mouseMove.y = readValue<std::int32_t>(in);
+                break;
+            default: /* Events without payload */
+                break;
+        }
+        events.push_back(recorded);
+    }
+    return events;
+}
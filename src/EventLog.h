@@ -0,0 +1,51 @@
+#ifndef NOUGHTS_AND_CROSSES_EVENTLOG_H
+#define NOUGHTS_AND_CROSSES_EVENTLOG_H
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/Window/Event.hpp>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A single input event captured by the EventRecorder.
+ */
+struct RecordedEvent {
+    sf::Int64 timestamp; /**< Microseconds elapsed since recording started. */
+    sf::Event event;     /**< The event as it was handed to the game. */
+};
+
+/**
+ * @brief Writes every processed event to a compact binary log.
+ *
+ * The log starts with a short header followed by one record per event: the timestamp, the event type
+ * and only the fields that type actually uses. Joystick, touch and sensor events are not recorded since
+ * the game ignores them. The stream is flushed after each record so the log survives a crash.
+ */
+class EventRecorder {
+    std::ofstream out;
+    sf::Clock clock;
+
+public:
+    /**
+     * @brief Opens the log file and writes the header.
+     * @param path The file to write the log to.
+     * @throws std::runtime_error if the file cannot be opened.
+     */
+    explicit EventRecorder(const std::string &path);
+    /**
+     * @brief Appends an event to the log, stamped with the time since recording started.
+     * @param event The event to record.
+     */
+    void record(const sf::Event &event);
+};
+
+/**
+ * @brief Reads a log written by EventRecorder.
+ * @param path The file to read the log from.
+ * @return The recorded events in the order they were processed.
+ * @throws std::runtime_error if the file cannot be opened or is not a valid event log.
+ */
+std::vector<RecordedEvent> loadEventLog(const std::string &path);
+
+#endif//NOUGHTS_AND_CROSSES_EVENTLOG_H
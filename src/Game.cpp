@@ -1,34 +1,23 @@
 #include "Game.h"
+#include <SFML/Graphics/View.hpp>
 #include <SFML/Window/Event.hpp>
 #include <iostream>
 #include <sstream>
 
-Winner markToWinner(Mark mark) {
-    Winner returnValue = Winner::NONE;
-    switch (mark) {
-        case Mark::X:
-            returnValue = Winner::X;
-            break;
-        case Mark::O:
-            returnValue = Winner::O;
-            break;
-        case Mark::EMPTY:
-            returnValue = Winner::NONE;
-            break;
-    }
-    return returnValue;
-}
+Game::Game() : Game(true) {}
 
-Game::Game() {
+Game::Game([[maybe_unused]] bool openWindow) {
 #ifndef TEST
-    window.create(sf::VideoMode(600, 600), "Noughts and Crosses");
-    window.setFramerateLimit(60);
+    if (openWindow) {
+        window.create(sf::VideoMode(DEFAULT_WINDOW_SIZE, DEFAULT_WINDOW_SIZE), "Noughts and Crosses");
+        window.setFramerateLimit(60);
+        layout.update(window.getSize()); /* the window manager may not grant the requested size */
+    }
 #endif
     loadFont();
-    setupGrid();
-    setupShapes();
     setupMenuText();
     setupInstructionsText();
+    applyLayout();
     initializeBoard();
     gameState = GameState::MENU;
     winner = Winner::NONE;
@@ -45,19 +34,46 @@ void Game::run() {
 void Game::processEvents() {
     sf::Event event{};
     while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed)
-            window.close();
-        if (event.type == sf::Event::MouseButtonPressed) {
-            if (gameState == GameState::MENU) {
-                handleMenuInput(event.mouseButton.button);
-            } else if (gameState == GameState::PLAYING) {
-                handlePlayerInput(event.mouseButton.button);
-            } else if (gameState == GameState::GAME_OVER) {
-                handleGameOver(event.mouseButton.button);
-            } else if (gameState == GameState::INSTRUCTIONS) {
-                handleInstructions(event.mouseButton.button);
-            }
+        if (recorder) {
+            recorder->record(event);
         }
+        handleEvent(event);
+    }
+}
+
+void Game::handleEvent(const sf::Event &event) {
+    if (event.type == sf::Event::Closed)
+        window.close();
+    if (event.type == sf::Event::Resized)
+        handleResize(sf::Vector2u(event.size.width, event.size.height));
+    if (event.type == sf::Event::MouseButtonPressed) {
+        sf::Mouse::Button button = event.mouseButton.button;
+        sf::Vector2i mousePos(event.mouseButton.x, event.mouseButton.y);
+        if (gameState == GameState::MENU) {
+            handleMenuInput(button, mousePos);
+        } else if (gameState == GameState::PLAYING) {
+            handlePlayerInput(button, mousePos);
+        } else if (gameState == GameState::GAME_OVER) {
+            handleGameOver(button, mousePos);
+        } else if (gameState == GameState::INSTRUCTIONS) {
+            handleInstructions(button, mousePos);
+        }
+    }
+}
+
+void Game::startRecording(const std::string &path) {
+    recorder = std::make_unique<EventRecorder>(path);
+    /* Clicks are mapped to cells with the current layout, so the replay has to start from the same size */
+    sf::Event resized{};
+    resized.type = sf::Event::Resized;
+    resized.size.width = layout.getWindowSize().x;
+    resized.size.height = layout.getWindowSize().y;
+    recorder->record(resized);
+}
+
+void Game::replay(const std::vector<RecordedEvent> &events) {
+    for (const auto &recorded: events) {
+        handleEvent(recorded.event);
     }
 }
 
@@ -80,9 +96,8 @@ void Game::render() {
     window.display();
 }
 
-void Game::handleMenuInput(sf::Mouse::Button button) {
+void Game::handleMenuInput(sf::Mouse::Button button, sf::Vector2i mousePos) {
     if (button == sf::Mouse::Left) {
-        sf::Vector2i mousePos = sf::Mouse::getPosition(window); /* specifically designed for handling 2D integer */
         for (int i = 0; i < menuText.size(); ++i) {
             if (menuText.at(i).getGlobalBounds().contains(static_cast<float>(mousePos.x), static_cast<float>(mousePos.y))) {
                 handleMenuSelection(i);
@@ -114,23 +129,7 @@ void Game::drawMenu() {
 }
 
 void Game::drawGame() {
-    for (const auto &line: grid) {
-        window.draw(line);
-    }
-    // Draw shapes on the board
-    for (int row = ROW_1; row < board.size(); ++row) {
-        for (int col = COL_1; col < board.at(COL_1).size(); ++col) {
-            if (board[row][col] == Mark::X) {
-                xShape[0].setPosition((float) col * 200.f + 100.f, (float) row * 200.f + 100.f);
-                xShape[1].setPosition((float) col * 200.f + 100.f, (float) row * 200.f + 100.f);
-                window.draw(xShape.at(0));
-                window.draw(xShape.at(1));
-            } else if (board[row][col] == Mark::O) {
-                oShape.setPosition((float) col * 200.f + 25.f, (float) row * 200.f + 25.f);
-                window.draw(oShape);
-            }
-        }
-    }
+    boardRenderer.draw(window, board, layout.getBoardTransform());
     window.display();
 }
 
@@ -147,35 +146,6 @@ void Game::initializeBoard() {
     }
 }
 
-void Game::setupGrid() {
-    // vertical grid lines
-    for (int i = 0; i < 2; ++i) {
-        grid[i].setFillColor(sf::Color(47, 79, 79));// 64
-        grid[i].setSize(sf::Vector2f(10.f, 600.f));
-        grid[i].setPosition(200.f * ((float) i + 1) - 5, 0.f);
-    }
-    // horizontal grid lines
-    for (int i = 2; i < 4; ++i) {
-        grid[i].setFillColor(sf::Color(47, 79, 79));// 64
-        grid[i].setSize(sf::Vector2f(600.f, 10.f));
-        grid[i].setPosition(0.f, 200.f * ((float) i - 1) - 5);
-    }
-}
-
-void Game::setupShapes() {
-    oShape.setRadius(75.f);
-    oShape.setFillColor(sf::Color::Transparent);
-    oShape.setOutlineColor(sf::Color(192, 192, 192));// Dark Blue - 0.0.139
-    oShape.setOutlineThickness(10.f);
-    for (auto &i: xShape) {
-        i.setSize(sf::Vector2f(160.f, 10.f));
-        i.setFillColor(sf::Color(192, 192, 192));//Black
-        i.setOrigin(80.f, 5.f);
-    }
-    xShape[0].setRotation(45.f);
-    xShape[1].setRotation(135.f);
-}
-
 void Game::loadFont() {
     std::vector<std::string> paths = {
             "../resources/ethn.otf",   // Local path
@@ -196,9 +166,7 @@ void Game::setupMenuText() {
     for (int i = 0; i < menuText.size(); i++) {
         menuText[i].setFont(font);
         menuText[i].setString(menuItems[i]);
-        menuText[i].setCharacterSize(30);
         menuText[i].setFillColor(sf::Color(211, 211, 211));//Black
-        menuText[i].setPosition(MENU_X_POS, MENU_START_Y + (MENU_OFFSET_Y * (float) i));
     }
 }
 
@@ -211,100 +179,64 @@ void Game::setupGameOver() {
     }
     gameOverText.setFont(font);
     gameOverText.setString(menuItems.str());
-    gameOverText.setCharacterSize(30);
     gameOverText.setFillColor(sf::Color(255, 255, 255));
-    gameOverText.setPosition(100.f, 150.f + 50.f);
 }
 
-void Game::handlePlayerInput(sf::Mouse::Button button) {
+void Game::handleResize(sf::Vector2u windowSize) {
+    window.setView(sf::View(sf::FloatRect(0.f, 0.f, (float) windowSize.x, (float) windowSize.y)));
+    layout.update(windowSize);
+    applyLayout();
+}
+
+void Game::applyLayout() {
+    for (std::size_t i = 0; i < menuText.size(); i++) {
+        menuText[i].setCharacterSize(layout.scaleCharacterSize(30));
+        menuText[i].setPosition(layout.toWindow(sf::Vector2f(MENU_X_POS, MENU_START_Y + (MENU_OFFSET_Y * (float) i))));
+    }
+    gameOverText.setCharacterSize(layout.scaleCharacterSize(30));
+    gameOverText.setPosition(layout.toWindow(sf::Vector2f(100.f, 150.f + 50.f)));
+    instructionsText.setCharacterSize(layout.scaleCharacterSize(18));
+    instructionsText.setPosition(layout.toWindow(sf::Vector2f(30.f, 20.f)));
+}
+
+void Game::handlePlayerInput(sf::Mouse::Button button, sf::Vector2i mousePos) {
     if (button != sf::Mouse::Left || gameState != GameState::PLAYING) {
         return;
     }
-    sf::Vector2i mousePos = sf::Mouse::getPosition(window);
-    int row = mousePos.y / 200;
-    int col = mousePos.x / 200;
-    if (row >= numRows || col >= numColumns || board[row][col] != Mark::EMPTY) {
+    std::optional<sf::Vector2i> cell = layout.cellAt(mousePos);
+    if (!cell || board[cell->y][cell->x] != Mark::EMPTY) {
         return;
     }
-    board[row][col] = isXTurn ? Mark::X : Mark::O;
+    board[cell->y][cell->x] = isXTurn ? Mark::X : Mark::O;
     turnNumber++;
     isXTurn = !isXTurn;
     if (turnNumber > WINNING_TURN_THRESHOLD) {
         winner = checkWinCondition();
         if (winner != Winner::NONE) {
             gameState = GameState::GAME_OVER;
+            setupGameOver();
         }
     }
 }
 
 Winner Game::checkWinCondition() {
-    winner = checkRows();
-    if (winner != Winner::NONE) {
-        return winner;
-    }
-    winner = checkColumns();
-    if (winner != Winner::NONE) {
-        return winner;
-    }
-    winner = checkDiagonals();
-    if (winner != Winner::NONE) {
-        return winner;
-    }
-    if (turnNumber == MAX_TURNS) {
-        return Winner::DRAW;
-    }
-    return winner;
-}
-
-Winner Game::checkRows() const {
-    for (const auto &row: board) {
-        if (checkLine(row[ROW_1], row[ROW_2], row[ROW_3])) {
-            return markToWinner(row[ROW_1]);
-        }
-    }
-    return Winner::NONE;
-}
-
-Winner Game::checkColumns() {
-    for (int col = COL_1; col < numColumns; ++col) {
-        if (checkLine(board[ROW_1][col], board[ROW_2][col], board[ROW_3][col])) {
-            return markToWinner(board[ROW_1][col]);
-        }
-    }
-    return Winner::NONE;
-}
-
-bool Game::checkLine(Mark a, Mark b, Mark c) {
-    return (a == b && b == c && a != Mark::EMPTY);
-}
-
-Winner Game::checkDiagonals() {
-    if (checkLine(board[ROW_1][COL_1], board[ROW_2][COL_2], board[ROW_3][COL_3])) {
-        return markToWinner(board[0][COL_1]);
-    }
-    if (checkLine(board[ROW_1][COL_3], board[ROW_2][COL_2], board[ROW_3][COL_1])) {
-        return markToWinner(board[ROW_1][COL_3]);
-    }
-    return Winner::NONE;
+    return ::checkWinCondition(board, turnNumber);
 }
 
 void Game::drawWinner() {
-    setupGameOver();
     window.draw(gameOverText);
 }
 
-void Game::handleGameOver(sf::Mouse::Button button) {
+void Game::handleGameOver(sf::Mouse::Button button, sf::Vector2i mousePos) {
     if (button == sf::Mouse::Left) {
-        sf::Vector2i mousePos = sf::Mouse::getPosition(window); /* specifically designed for handling 2D integer */
         if (gameOverText.getGlobalBounds().contains(static_cast<float>(mousePos.x), static_cast<float>(mousePos.y))) {
             resetGame();
         }
     }
 }
 
-void Game::handleInstructions(sf::Mouse::Button button) {
+void Game::handleInstructions(sf::Mouse::Button button, sf::Vector2i mousePos) {
     if (button == sf::Mouse::Left) {
-        sf::Vector2i mousePos = sf::Mouse::getPosition(window); /* specifically designed for handling 2D integer */
         if (instructionsText.getGlobalBounds().contains(static_cast<float>(mousePos.x), static_cast<float>(mousePos.y))) {
             gameState = GameState::MENU;
         }
@@ -333,9 +265,7 @@ void Game::setupInstructionsText() {
 
     instructionsText.setFont(font);
     instructionsText.setString(instructions);
-    instructionsText.setCharacterSize(18);
     instructionsText.setFillColor(sf::Color::White);// Dark Mode Color
-    instructionsText.setPosition(30.f, 20.f);
     instructionsText.setLineSpacing(1.3f);
 }
 
@@ -354,3 +284,7 @@ int Game::getTurnNumber() const {
 GameState Game::getGameState() const {
     return gameState;
 }
+
+Winner Game::getWinner() const {
+    return winner;
+}
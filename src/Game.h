@@ -2,59 +2,22 @@
 #define NOUGHTS_AND_CROSSES_GAME_H
 
 #include <SFML/Graphics/RenderWindow.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/CircleShape.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Window/Mouse.hpp>
+#include "Board.h"
+#include "BoardRenderer.h"
+#include "EventLog.h"
+#include "Layout.h"
 #include <array>
-
-/**
- * @brief The number of rows on the game board.
- *
- * This constant defines the number of rows present on the game board. It is used to determine the
- * vertical dimension of the board.
- */
-constexpr int numRows = 3;
-/**
- * @brief The number of columns on the game board.
- *
- * This constant defines the number of columns present on the game board. It is used to determine the
- * horizontal dimension of the board.
- */
-constexpr int numColumns = 3;
-
-/**
- * @brief Index of the first row (0-based index).
- */
-constexpr int ROW_1 = 0;
-/**
- * @brief Index of the second row (1-based index).
- */
-constexpr int ROW_2 = 1;
-/**
- * @brief Index of the third row (2-based index).
- */
-constexpr int ROW_3 = 2;
-
-/**
- * @brief Index of the first column (0-based index).
- */
-constexpr int COL_1 = 0;
-/**
- * @brief Index of the second column (1-based index).
- */
-constexpr int COL_2 = 1;
-/**
- * @brief Index of the third column (2-based index).
- */
-constexpr int COL_3 = 2;
+#include <memory>
+#include <vector>
 
 /**
  * @brief The vertical starting position of menu items.
  *
- * This constant defines the vertical offset from the top of the window where the menu items will start.
- * It is used to position the menu items in a vertical arrangement.
+ * This constant defines the vertical offset from the top of the board where the menu items will start,
+ * in design units (see Layout). It is used to position the menu items in a vertical arrangement.
  */
 constexpr float MENU_START_Y = 200.f;
 /**
@@ -67,21 +30,10 @@ constexpr float MENU_OFFSET_Y = 50.f;
 /**
  * @brief The horizontal position of the menu items.
  *
- * This constant sets the horizontal position where the menu items will be displayed. It is used for
- * aligning the menu items horizontally in the window.
+ * This constant sets the horizontal position where the menu items will be displayed, in design units
+ * (see Layout). It is used for aligning the menu items horizontally in the window.
  */
 constexpr float MENU_X_POS = 150.f;
-/**
- * @brief The minimum number of turns required before checking for a winning condition.
- *
- * This helps to optimize the game by not checking for a win until it's possible.
- */
-constexpr int WINNING_TURN_THRESHOLD = 4;
-/**
- * @brief The maximum number of turns in the game, representing a full board without a winner.
- */
-constexpr int MAX_TURNS = 9;
-
 /**
  * @brief Enum representing the different states of the game.
  */
@@ -91,29 +43,6 @@ enum class GameState {
     PLAYING,
     GAME_OVER
 };
-/**
- * @brief Enum representing the winner of the game.
- *
- * This enum is used to indicate the final outcome of the game.
- */
-enum class Winner {
-    X = 'X',    /**< Player X has won the game. */
-    O = 'O',    /**< Player O has won the game. */
-    DRAW = 'D', /**< The game ended in a draw. */
-    NONE = ' '  /**< The game is still ongoing or no winner has been determined. */
-};
-
-/**
- * @brief Enum representing the state of a cell on the game board.
- *
- * This enum is used to mark each cell on the board with either X, O, or as EMPTY.
- */
-enum class Mark {
-    X = 'X',    /**< Cell is marked by Player X. */
-    O = 'O',    /**< Cell is marked by Player O. */
-    EMPTY = ' ' /**< Cell is empty and unmarked. */
-};
-
 /**
  * @brief Class representing the Noughts and Crosses game.
  */
@@ -123,14 +52,6 @@ class Game {
      * @throws std::runtime_error if the font cannot be loaded.
      */
     void loadFont();
-    /**
-     * @brief Sets up the grid lines.
-     */
-    void setupGrid();
-    /**
-     * @brief Sets up the shapes for 'X' and 'O'.
-     */
-    void setupShapes();
     /**
      * @brief Sets up the menu text using the loaded font.
      */
@@ -140,7 +61,7 @@ class Game {
      */
     void initializeBoard();
     /**
-     * @brief Processes input events.
+     * @brief Processes input events, recording them first if recording is enabled.
      */
     void processEvents();
     /**
@@ -150,19 +71,22 @@ class Game {
     /**
      * @brief Handles input in the menu.
      * @param button The mouse button that was pressed.
+     * @param mousePos The position of the mouse when the button was pressed.
      */
-    void handleMenuInput(sf::Mouse::Button button);
+    void handleMenuInput(sf::Mouse::Button button, sf::Vector2i mousePos);
 
     /**
      * @brief Handles player input during the game.
      * @param button The mouse button that was pressed.
+     * @param mousePos The position of the mouse when the button was pressed.
      */
-    void handlePlayerInput(sf::Mouse::Button button);
+    void handlePlayerInput(sf::Mouse::Button button, sf::Vector2i mousePos);
     /**
      * @brief Handles game over.
      * @param button The mouse button that was pressed.
+     * @param mousePos The position of the mouse when the button was pressed.
      */
-    void handleGameOver(sf::Mouse::Button button);
+    void handleGameOver(sf::Mouse::Button button, sf::Vector2i mousePos);
     /**
      * @brief Handles the action associated with the given menu index selected.
      * @param index The index of the menu item.
@@ -187,50 +111,36 @@ class Game {
      */
     void setupGameOver();
     /**
-     * @brief Checks the win condition for the game.
-     * @return The winner enum of the winning player or draw.
+     * @brief Recomputes the layout for a new window size and moves the texts accordingly.
+     * @param windowSize The new size of the window, in pixels.
      */
-    Winner checkWinCondition();
+    void handleResize(sf::Vector2u windowSize);
     /**
-     * @brief Checks if three characters are the same and not empty.
-     * @param a First character.
-     * @param b Second character.
-     * @param c Third character.
-     * @return true if all three characters are the same and not empty, false otherwise.
+     * @brief Positions and sizes the texts for the current layout.
      */
-    static bool checkLine(Mark a, Mark b, Mark c);
+    void applyLayout();
     /**
-     * @brief Checks all columns for a win condition.
-     * @return The winner enum of the winning player.
-     */
-    Winner checkColumns();
-    /**
-     * @brief Checks all rows for a win condition.
-     * @return The winner enum of the winning player.
-     */
-    Winner checkRows() const;
-    /**
-     * @brief Checks both diagonals for a win condition.
-     * @return The winner enum of the winning player.
+     * @brief Checks the win condition for the game.
+     * @return The winner enum of the winning player or draw.
      */
-    Winner checkDiagonals();
+    Winner checkWinCondition();
 
     void setupInstructionsText();
 
     sf::RenderWindow window;
-    std::array<sf::RectangleShape, 4> grid;
-    sf::CircleShape oShape;
-    std::array<sf::RectangleShape, 2> xShape;
+    BoardRenderer boardRenderer;
+    Layout layout{sf::Vector2u(DEFAULT_WINDOW_SIZE, DEFAULT_WINDOW_SIZE)};
     sf::Font font;
     std::array<sf::Text, 3> menuText;
     sf::Text menuWinner;
-    std::array<std::array<Mark, numRows>, numColumns> board{};
+    Board board{};
     GameState gameState;
     bool isXTurn;
     Winner winner;
     sf::Text gameOverText;
     int turnNumber = 0;
     sf::Text instructionsText;
+    std::unique_ptr<EventRecorder> recorder;
     friend class GameTests;
 
 public:
@@ -238,11 +148,35 @@ public:
      * @brief Constructs a Game object and initializes the game.
      */
     Game();
+    /**
+     * @brief Constructs a Game object, optionally without opening a window.
+     * @param openWindow false to run headless, e.g. when replaying an event log.
+     */
+    explicit Game(bool openWindow);
     /**
      * @brief Runs the game loop.
      */
     void run();
-    void handleInstructions(sf::Mouse::Button button);
+    /**
+     * @brief Applies a single input event to the game.
+     * @param event The event to handle.
+     */
+    void handleEvent(const sf::Event &event);
+    /**
+     * @brief Records every event processed from now on to a log file.
+     *
+     * The log starts with a Resized event for the current window size, so a replay maps clicks to the
+     * same cells.
+     * @param path The file to write the event log to.
+     * @throws std::runtime_error if the file cannot be opened.
+     */
+    void startRecording(const std::string &path);
+    /**
+     * @brief Feeds recorded events to the game as fast as possible, without rendering.
+     * @param events The events to replay, in the order they were recorded.
+     */
+    void replay(const std::vector<RecordedEvent> &events);
+    void handleInstructions(sf::Mouse::Button button, sf::Vector2i mousePos);
     /**
      * @brief Resets the game state and board.
      */
@@ -250,6 +184,7 @@ public:
     bool getIsXTurn() const;
     int getTurnNumber() const;
     GameState getGameState() const;
+    Winner getWinner() const;
 };
 
 #endif //NOUGHTS_AND_CROSSES_GAME_H
@@ -0,0 +1,59 @@
+#include "Layout.h"
+#include <algorithm>
+#include <cmath>
+
+Layout::Layout(sf::Vector2u windowSize, int rows, int columns) : rows(rows), columns(columns) {
+    update(windowSize);
+}
+
+void Layout::update(sf::Vector2u windowSize) {
+    this->windowSize = windowSize;
+    float width = (float) windowSize.x;
+    float height = (float) windowSize.y;
+    cellSize = std::min(width / (float) columns, height / (float) rows);
+    scale = cellSize / CELL_SIZE;
+    boardOrigin = sf::Vector2f((width - cellSize * (float) columns) / 2, (height - cellSize * (float) rows) / 2);
+    boardTransform = sf::Transform();
+    boardTransform.translate(boardOrigin);
+    boardTransform.scale(scale, scale);
+}
+
+std::optional<sf::Vector2i> Layout::cellAt(sf::Vector2i position) const {
+    if (cellSize <= 0.f) {
+        return std::nullopt;
+    }
+    auto col = (int) std::floor(((float) position.x - boardOrigin.x) / cellSize);
+    auto row = (int) std::floor(((float) position.y - boardOrigin.y) / cellSize);
+    if (row < 0 || col < 0 || row >= rows || col >= columns) {
+        return std::nullopt;
+    }
+    return sf::Vector2i(col, row);
+}
+
+sf::Vector2f Layout::toWindow(sf::Vector2f position) const {
+    return boardTransform.transformPoint(position);
+}
+
+unsigned Layout::scaleCharacterSize(unsigned size) const {
+    return std::max(1u, (unsigned) std::lround((float) size * scale));
+}
+
+const sf::Transform &Layout::getBoardTransform() const {
+    return boardTransform;
+}
+
+sf::Vector2u Layout::getWindowSize() const {
+    return windowSize;
+}
+
+float Layout::getCellSize() const {
+    return cellSize;
+}
+
+float Layout::getScale() const {
+    return scale;
+}
+
+sf::Vector2f Layout::getBoardOrigin() const {
+    return boardOrigin;
+}
@@ -0,0 +1,84 @@
+#ifndef NOUGHTS_AND_CROSSES_LAYOUT_H
+#define NOUGHTS_AND_CROSSES_LAYOUT_H
+
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/System/Vector2.hpp>
+#include "Board.h"
+#include <optional>
+
+/**
+ * @brief The width and height of a single cell on the game board, in design units.
+ *
+ * Design units are the pixels of the default window; the layout scales them to the actual window size.
+ */
+constexpr float CELL_SIZE = 200.f;
+/**
+ * @brief The width of the whole game board, in design units.
+ */
+constexpr float BOARD_WIDTH = CELL_SIZE * numColumns;
+/**
+ * @brief The height of the whole game board, in design units.
+ */
+constexpr float BOARD_HEIGHT = CELL_SIZE * numRows;
+/**
+ * @brief The initial width and height of the window, in pixels.
+ */
+constexpr unsigned DEFAULT_WINDOW_SIZE = 600;
+
+/**
+ * @brief Maps the design coordinates of the board and menus to window pixels.
+ *
+ * The board is scaled uniformly to the largest size that fits the window and centered in it. The geometry
+ * is computed once by update(), typically when the window is resized, and cached until the next update.
+ */
+class Layout {
+    int rows;
+    int columns;
+    sf::Vector2u windowSize;
+    float cellSize = 0.f;
+    float scale = 0.f;
+    sf::Vector2f boardOrigin;
+    sf::Transform boardTransform;
+
+public:
+    /**
+     * @brief Constructs a Layout for a window of the given size.
+     * @param windowSize The size of the window, in pixels.
+     * @param rows The number of rows on the board.
+     * @param columns The number of columns on the board.
+     */
+    explicit Layout(sf::Vector2u windowSize, int rows = numRows, int columns = numColumns);
+    /**
+     * @brief Recomputes the geometry for a new window size.
+     * @param windowSize The size of the window, in pixels.
+     */
+    void update(sf::Vector2u windowSize);
+    /**
+     * @brief Finds the cell under a point of the window.
+     * @param position The point, in pixels.
+     * @return The column (x) and row (y) of the cell, or std::nullopt if the point is outside the board.
+     */
+    std::optional<sf::Vector2i> cellAt(sf::Vector2i position) const;
+    /**
+     * @brief Converts a point from design units to window pixels.
+     * @param position The point, in design units.
+     * @return The point, in pixels.
+     */
+    sf::Vector2f toWindow(sf::Vector2f position) const;
+    /**
+     * @brief Scales a character size from design units to window pixels.
+     * @param size The character size, in design units.
+     * @return The character size, in pixels, at least 1.
+     */
+    unsigned scaleCharacterSize(unsigned size) const;
+    /**
+     * @brief Gets the transform from design units to window pixels, used to draw the board.
+     */
+    const sf::Transform &getBoardTransform() const;
+    sf::Vector2u getWindowSize() const;
+    float getCellSize() const;
+    float getScale() const;
+    sf::Vector2f getBoardOrigin() const;
+};
+
+#endif//NOUGHTS_AND_CROSSES_LAYOUT_H
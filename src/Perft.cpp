@@ -0,0 +1,105 @@
+#include "Perft.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    class PerftCounter {
+        bool useTranspositions;
+        std::unordered_map<std::uint64_t, std::uint64_t> transpositions;
+
+        /* Encodes the board in base 3 together with the remaining depth */
+        static std::uint64_t key(const Board &board, int depth) {
+            std::uint64_t code = 0;
+            for (const auto &row: board) {
+                for (Mark cell: row) {
+                    code = code * 3 + (cell == Mark::EMPTY ? 0 : cell == Mark::X ? 1 : 2);
+                }
+            }
+            return code * (MAX_TURNS + 1) + depth;
+        }
+
+    public:
+        std::uint64_t nodes = 0;
+
+        explicit PerftCounter(bool useTranspositions) : useTranspositions(useTranspositions) {}
+
+        std::uint64_t count(Board &board, int turnNumber, int depth) {
+            if (depth == 0 || (turnNumber > WINNING_TURN_THRESHOLD && checkWinCondition(board, turnNumber) != Winner::NONE)) {
+                ++nodes;
+                return 1;
+            }
+            std::uint64_t hash = 0;
+            if (useTranspositions) {
+                hash = key(board, depth);
+                if (auto found = transpositions.find(hash); found != transpositions.end()) {
+                    return found->second;
+                }
+            }
+            ++nodes;
+            Mark mark = turnNumber % 2 == 0 ? Mark::X : Mark::O;
+            std::uint64_t sequences = 0;
+            for (auto &row: board) {
+                for (Mark &cell: row) {
+                    if (cell == Mark::EMPTY) {
+                        cell = mark;
+                        sequences += count(board, turnNumber + 1, depth - 1);
+                        cell = Mark::EMPTY;
+                    }
+                }
+            }
+            if (useTranspositions) {
+                transpositions.emplace(hash, sequences);
+            }
+            return sequences;
+        }
+    };
+
+    int countMarks(const Board &board) {
+        int marks = 0;
+        for (const auto &row: board) {
+            marks += (int) std::count_if(row.begin(), row.end(), [](Mark cell) { return cell != Mark::EMPTY; });
+        }
+        return marks;
+    }
+}// namespace
+
+PerftResult perft(const Board &board, int depth, unsigned threads, bool useTranspositions) {
+    int turnNumber = countMarks(board);
+    if (depth <= 0 || (turnNumber > WINNING_TURN_THRESHOLD && checkWinCondition(board, turnNumber) != Winner::NONE)) {
+        return {1, 1, 1};
+    }
+
+    std::vector<Board> children;
+    Mark mark = turnNumber % 2 == 0 ? Mark::X : Mark::O;
+    for (int row = ROW_1; row < numRows; ++row) {
+        for (int col = COL_1; col < numColumns; ++col) {
+            if (board[row][col] == Mark::EMPTY) {
+                children.push_back(board);
+                children.back()[row][col] = mark;
+            }
+        }
+    }
+
+    std::atomic<std::size_t> next = 0;
+    std::atomic<std::uint64_t> sequences = 0;
+    std::atomic<std::uint64_t> nodes = 1; /* the root */
+    auto worker = [&]() {
+        PerftCounter counter(useTranspositions);
+        std::uint64_t workerSequences = 0;
+        for (std::size_t i = next++; i < children.size(); i = next++) {
+            workerSequences += counter.count(children[i], turnNumber + 1, depth - 1);
+        }
+        sequences += workerSequences;
+        nodes += counter.nodes;
+    };
+    auto workers = static_cast<unsigned>(std::clamp<std::size_t>(threads, 1, children.size()));
+    std::vector<std::jthread> pool;
+    for (unsigned t = 0; t < workers; ++t) {
+        pool.emplace_back(worker);
+    }
+    pool.clear(); /* joins all threads */
+    return {sequences, nodes, workers};
+}
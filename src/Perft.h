@@ -0,0 +1,38 @@
+#ifndef NOUGHTS_AND_CROSSES_PERFT_H
+#define NOUGHTS_AND_CROSSES_PERFT_H
+
+#include "Board.h"
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief The number of move sequences from the empty board for each depth, used as a correctness oracle.
+ *
+ * Depth 9 is the number of complete games.
+ */
+constexpr std::array<std::uint64_t, MAX_TURNS + 1> KNOWN_SEQUENCES = {
+        1, 9, 72, 504, 3024, 15120, 56160, 154944, 255168, 255168};
+
+/**
+ * @brief The outcome of a perft run.
+ */
+struct PerftResult {
+    std::uint64_t sequences; /**< Move sequences of the given depth, or shorter when a game ended. */
+    std::uint64_t nodes;     /**< Positions visited; with transpositions, only the ones not found in the table. */
+    unsigned threads;        /**< Threads actually used, at most one per move of the root position. */
+};
+
+/**
+ * @brief Counts all legal move sequences from a position.
+ *
+ * A sequence stops early when checkWinCondition reports a winner or a draw. The moves of the root position
+ * are split over a pool of threads.
+ * @param board The position to start from; the player to move follows from the number of marks.
+ * @param depth The maximum number of moves in a sequence.
+ * @param threads The maximum number of threads.
+ * @param useTranspositions true to count positions reached by different move orders only once per thread.
+ * @return The number of sequences and visited positions.
+ */
+PerftResult perft(const Board &board, int depth, unsigned threads, bool useTranspositions);
+
+#endif//NOUGHTS_AND_CROSSES_PERFT_H
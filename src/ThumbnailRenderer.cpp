@@ -0,0 +1,209 @@
+#include "ThumbnailRenderer.h"
+#include <SFML/Graphics/Image.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+    std::string numberedFile(const std::string &directory, const char *prefix, std::size_t index) {
+        std::array<char, 32> name{};
+        std::snprintf(name.data(), name.size(), "%s_%06zu.png", prefix, index);
+        return (std::filesystem::path(directory) / name.data()).string();
+    }
+
+    /* A rendered atlas page, freed once the last job referring to it has finished. */
+    struct Page {
+        sf::Image image;
+        std::size_t index;
+        std::size_t firstBoard;
+        std::size_t boardCount;
+    };
+
+    /* Runs encoding jobs on a pool of threads and limits the number of pages waiting for them. */
+    class EncodingPool {
+        std::mutex mutex;
+        std::condition_variable jobAvailable;
+        std::condition_variable pageReleased;
+        std::deque<std::function<void()>> jobs;
+        std::size_t pagesInFlight = 0;
+        bool closed = false;
+        std::string error;
+        std::vector<std::jthread> workers;
+
+        void work() {
+            while (true) {
+                std::function<void()> job;
+                {
+                    std::unique_lock lock(mutex);
+                    jobAvailable.wait(lock, [this] { return closed || !jobs.empty(); });
+                    if (jobs.empty()) {
+                        return;
+                    }
+                    job = std::move(jobs.front());
+                    jobs.pop_front();
+                    if (!error.empty()) {
+                        continue; /* drop the job; destroying it releases its page */
+                    }
+                }
+                try {
+                    job();
+                } catch (const std::runtime_error &e) {
+                    std::scoped_lock lock(mutex);
+                    if (error.empty()) {
+                        error = e.what();
+                    }
+                }
+            }
+        }
+
+        void releasePage() {
+            {
+                std::scoped_lock lock(mutex);
+                --pagesInFlight;
+            }
+            pageReleased.notify_one();
+        }
+
+    public:
+        explicit EncodingPool(unsigned threads) {
+            for (unsigned t = 0; t < std::max(1u, threads); ++t) {
+                workers.emplace_back([this] { work(); });
+            }
+        }
+
+        ~EncodingPool() {
+            {
+                std::scoped_lock lock(mutex);
+                closed = true;
+            }
+            jobAvailable.notify_all();
+            workers.clear(); /* joins all threads */
+        }
+
+        /* Blocks until fewer than MAX_PAGES_IN_FLIGHT pages are held, then takes ownership of a new one. */
+        std::shared_ptr<Page> acquirePage() {
+            std::unique_lock lock(mutex);
+            pageReleased.wait(lock, [this] { return pagesInFlight < MAX_PAGES_IN_FLIGHT; });
+            ++pagesInFlight;
+            return {new Page{}, [this](Page *page) {
+                        delete page;
+                        releasePage();
+                    }};
+        }
+
+        void submit(std::function<void()> job) {
+            {
+                std::scoped_lock lock(mutex);
+                jobs.push_back(std::move(job));
+            }
+            jobAvailable.notify_one();
+        }
+
+        bool failed() {
+            std::scoped_lock lock(mutex);
+            return !error.empty();
+        }
+
+        /* Waits for all jobs to finish. Throws std::runtime_error if any job failed. */
+        void finish() {
+            {
+                std::scoped_lock lock(mutex);
+                closed = true;
+            }
+            jobAvailable.notify_all();
+            workers.clear();
+            if (!error.empty()) {
+                throw std::runtime_error(error);
+            }
+        }
+    };
+}// namespace
+
+sf::IntRect atlasSlotArea(std::size_t slot, unsigned boardsPerRow, unsigned thumbnailSize) {
+    auto column = (int) (slot % boardsPerRow);
+    auto row = (int) (slot / boardsPerRow);
+    auto size = (int) thumbnailSize;
+    return {column * size, row * size, size, size};
+}
+
+ThumbnailRenderer::ThumbnailRenderer(unsigned thumbnailSize, unsigned atlasSize)
+    : thumbnailSize(thumbnailSize), boardsPerRow(std::max(1u, atlasSize / thumbnailSize)) {
+    unsigned pageSize = boardsPerRow * thumbnailSize;
+    /* Lines end up about one pixel wide at thumbnail scale, so the diagonal X bars need antialiasing.
+     * Software renderers such as llvmpipe support fewer samples, and create() fails above their maximum. */
+    sf::ContextSettings settings;
+    settings.antialiasingLevel = std::min(8u, sf::RenderTexture::getMaximumAntialiasingLevel());
+    bool isCreated = texture.create(pageSize, pageSize, settings);
+    if (!isCreated && settings.antialiasingLevel > 0) {
+        settings.antialiasingLevel = 0;
+        isCreated = texture.create(pageSize, pageSize, settings);
+    }
+    if (!isCreated) {
+        throw std::runtime_error("Error creating render texture: " + std::to_string(pageSize) + "x" + std::to_string(pageSize) + " is not supported.");
+    }
+}
+
+std::size_t ThumbnailRenderer::render(const std::vector<Board> &boards, const std::string &directory, unsigned threads, bool saveAtlases) {
+    EncodingPool pool(threads);
+    sf::VertexArray vertices(sf::Triangles);
+    Layout layout(sf::Vector2u(thumbnailSize, thumbnailSize));
+    std::size_t perAtlas = getBoardsPerAtlas();
+    std::size_t pageCount = 0;
+    for (std::size_t first = 0; first < boards.size() && !pool.failed(); first += perAtlas) {
+        vertices.clear();
+        std::size_t last = std::min(first + perAtlas, boards.size());
+        for (std::size_t i = first; i < last; ++i) {
+            sf::IntRect area = atlasSlotArea(i - first, boardsPerRow, thumbnailSize);
+            sf::Transform transform;
+            transform.translate((float) area.left, (float) area.top);
+            transform.combine(layout.getBoardTransform());
+            boardRenderer.appendBoard(vertices, boards[i], transform);
+        }
+        texture.clear(sf::Color(18, 18, 18));
+        texture.draw(vertices);
+        texture.display();
+
+        std::shared_ptr<Page> page = pool.acquirePage();
+        page->image = texture.getTexture().copyToImage();
+        page->index = pageCount++;
+        page->firstBoard = first;
+        page->boardCount = last - first;
+        if (saveAtlases) {
+            pool.submit([page, &directory] {
+                std::string path = numberedFile(directory, "atlas", page->index);
+                if (!page->image.saveToFile(path)) {
+                    throw std::runtime_error("Error saving atlas: Cannot write " + path + ".");
+                }
+            });
+            continue;
+        }
+        /* One job per row of thumbnails keeps the queue short while still spreading a page over all threads */
+        for (std::size_t rowStart = 0; rowStart < page->boardCount; rowStart += boardsPerRow) {
+            pool.submit([this, page, rowStart, &directory] {
+                std::size_t rowEnd = std::min<std::size_t>(rowStart + boardsPerRow, page->boardCount);
+                for (std::size_t slot = rowStart; slot < rowEnd; ++slot) {
+                    sf::Image thumbnail;
+                    thumbnail.create(thumbnailSize, thumbnailSize);
+                    thumbnail.copy(page->image, 0, 0, atlasSlotArea(slot, boardsPerRow, thumbnailSize));
+                    std::string path = numberedFile(directory, "board", page->firstBoard + slot);
+                    if (!thumbnail.saveToFile(path)) {
+                        throw std::runtime_error("Error saving thumbnail: Cannot write " + path + ".");
+                    }
+                }
+            });
+        }
+    }
+    pool.finish();
+    return pageCount;
+}
+
+unsigned ThumbnailRenderer::getBoardsPerAtlas() const {
+    return boardsPerRow * boardsPerRow;
+}
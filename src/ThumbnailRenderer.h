@@ -0,0 +1,61 @@
+#ifndef NOUGHTS_AND_CROSSES_THUMBNAILRENDERER_H
+#define NOUGHTS_AND_CROSSES_THUMBNAILRENDERER_H
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include "BoardRenderer.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief The maximum number of rendered atlas pages held in memory while waiting to be encoded.
+ */
+constexpr std::size_t MAX_PAGES_IN_FLIGHT = 3;
+
+/**
+ * @brief Gets the area of a thumbnail on an atlas page.
+ * @param slot The index of the thumbnail on the page, row by row from the top left corner.
+ * @param boardsPerRow The number of thumbnails in a row of the page.
+ * @param thumbnailSize The width and height of a thumbnail, in pixels.
+ * @return The area of the thumbnail, in pixels.
+ */
+sf::IntRect atlasSlotArea(std::size_t slot, unsigned boardsPerRow, unsigned thumbnailSize);
+
+/**
+ * @brief Renders board thumbnails offscreen, without opening a window.
+ *
+ * Boards are laid out on square atlas pages; all boards of a page are drawn with a single draw call
+ * into an sf::RenderTexture. Each page is handed to a pool of threads that encodes it to PNG while
+ * the next page is rendered. At most MAX_PAGES_IN_FLIGHT pages are kept in memory.
+ */
+class ThumbnailRenderer {
+    BoardRenderer boardRenderer;
+    sf::RenderTexture texture;
+    unsigned thumbnailSize;
+    unsigned boardsPerRow;
+
+public:
+    /**
+     * @brief Constructs a ThumbnailRenderer.
+     * @param thumbnailSize The width and height of a thumbnail, in pixels.
+     * @param atlasSize The maximum width and height of an atlas page, in pixels.
+     * @throws std::runtime_error if the render texture cannot be created.
+     */
+    ThumbnailRenderer(unsigned thumbnailSize, unsigned atlasSize);
+    /**
+     * @brief Renders boards and saves them as PNG files.
+     *
+     * Thumbnails are saved as board_000000.png, board_000001.png, ... or, if saveAtlases is set, the
+     * whole pages as atlas_000000.png, atlas_000001.png, ...
+     * @param boards The boards to render.
+     * @param directory The directory to write to.
+     * @param threads The number of encoding threads.
+     * @param saveAtlases true to save the atlas pages instead of single thumbnails.
+     * @return The number of atlas pages rendered.
+     * @throws std::runtime_error if an image cannot be saved.
+     */
+    std::size_t render(const std::vector<Board> &boards, const std::string &directory, unsigned threads, bool saveAtlases);
+    unsigned getBoardsPerAtlas() const;
+};
+
+#endif//NOUGHTS_AND_CROSSES_THUMBNAILRENDERER_H
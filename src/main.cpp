@@ -1,10 +1,19 @@
 #include <iostream>
+#include <string>
 #include "Game.h"
 
-int main()
+int main(int argc, char *argv[])
 {
+    bool isRecording = argc == 3 && std::string(argv[1]) == "--record";
+    if (argc != 1 && !isRecording) {
+        std::cerr << "Usage: " << argv[0] << " [--record <event-log>]" << std::endl;
+        return EXIT_FAILURE;
+    }
     try {
         Game game{};
+        if (isRecording) {
+            game.startRecording(argv[2]);
+        }
         game.run();
     } catch (const std::runtime_error& e) {
         std::cerr << "Failed to start the game: " << e.what() << std::endl;
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "CommandLine.h"
+#include "Perft.h"
+
+namespace {
+    int usage(const char *program) {
+        std::cerr << "Usage: " << program << " [depth] [--board <cells>] [--threads <count>] [--hash]" << std::endl
+                  << "The board holds the cells in row-major order, e.g. XO..X...O; the default is the empty board."
+                  << std::endl;
+        return 2;
+    }
+
+    /* X always moves first, so X has either as many marks as O or one more. */
+    bool isReachable(const Board &board) {
+        int xMarks = 0;
+        int oMarks = 0;
+        for (const auto &row: board) {
+            for (Mark cell: row) {
+                xMarks += cell == Mark::X;
+                oMarks += cell == Mark::O;
+            }
+        }
+        return xMarks == oMarks || xMarks == oMarks + 1;
+    }
+}// namespace
+
+/* Counts all move sequences from a position and reports the throughput. From the empty board the count is
+ * checked against the known totals, so new board representations can be validated before they are used. */
+int main(int argc, char *argv[]) {
+    int depth = MAX_TURNS;
+    Board board{};
+    for (auto &row: board) {
+        row.fill(Mark::EMPTY);
+    }
+    const Board emptyBoard = board;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    bool useTranspositions = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--hash") {
+            useTranspositions = true;
+        } else if (option == "--board" && i + 1 < argc) {
+            std::optional<Board> parsed = parseBoard(argv[++i]);
+            if (!parsed || !isReachable(*parsed)) {
+                std::cerr << "Invalid board: " << argv[i] << std::endl;
+                return 2;
+            }
+            board = *parsed;
+        } else if (option == "--threads" && i + 1 < argc) {
+            std::optional<unsigned> count = parseNumber(argv[++i]);
+            if (!count || *count == 0) {
+                return usage(argv[0]);
+            }
+            threads = *count;
+        } else if (std::optional<unsigned> number = parseNumber(option)) {
+            depth = static_cast<int>(std::min(*number, static_cast<unsigned>(MAX_TURNS)));
+        } else {
+            return usage(argv[0]);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    PerftResult result = perft(board, depth, threads, useTranspositions);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "depth " << depth << ": " << result.sequences << " sequences, " << result.nodes << " nodes in "
+              << elapsed.count() * 1000 << " ms (" << static_cast<std::uint64_t>((double) result.nodes / elapsed.count())
+              << " nodes/s, " << result.threads << " threads" << (useTranspositions ? ", transpositions" : "") << ")" << std::endl;
+
+    if (board == emptyBoard) {
+        std::uint64_t expected = KNOWN_SEQUENCES.at(depth);
+        if (result.sequences != expected) {
+            std::cerr << "FAILED: expected " << expected << " sequences" << std::endl;
+            return 1;
+        }
+        std::cout << "OK: matches the known total" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <chrono>
+#include <iostream>
+#include <optional>
+#include <string>
+#include "Game.h"
+
+namespace {
+    std::optional<GameState> parseGameState(const std::string &name) {
+        if (name == "MENU") return GameState::MENU;
+        if (name == "INSTRUCTIONS") return GameState::INSTRUCTIONS;
+        if (name == "PLAYING") return GameState::PLAYING;
+        if (name == "GAME_OVER") return GameState::GAME_OVER;
+        return std::nullopt;
+    }
+
+    std::optional<Winner> parseWinner(const std::string &name) {
+        if (name == "X") return Winner::X;
+        if (name == "O") return Winner::O;
+        if (name == "DRAW") return Winner::DRAW;
+        if (name == "NONE") return Winner::NONE;
+        return std::nullopt;
+    }
+
+    std::string gameStateName(GameState state) {
+        switch (state) {
+            case GameState::MENU:
+                return "MENU";
+            case GameState::INSTRUCTIONS:
+                return "INSTRUCTIONS";
+            case GameState::PLAYING:
+                return "PLAYING";
+            case GameState::GAME_OVER:
+                return "GAME_OVER";
+        }
+        return "UNKNOWN";
+    }
+
+    std::string winnerName(Winner winner) {
+        switch (winner) {
+            case Winner::X:
+                return "X";
+            case Winner::O:
+                return "O";
+            case Winner::DRAW:
+                return "DRAW";
+            case Winner::NONE:
+                return "NONE";
+        }
+        return "UNKNOWN";
+    }
+
+    int usage(const char *program) {
+        std::cerr << "Usage: " << program << " <event-log> [--expect-state MENU|INSTRUCTIONS|PLAYING|GAME_OVER]"
+                  << " [--expect-winner X|O|DRAW|NONE]" << std::endl;
+        return 2;
+    }
+}// namespace
+
+/* Replays a log recorded with `noughts_and_crosses --record` without a window or frame limiter
+ * and checks the final state, so recorded bug reports can be used as regression runs. */
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        return usage(argv[0]);
+    }
+    std::optional<GameState> expectedState;
+    std::optional<Winner> expectedWinner;
+    for (int i = 2; i < argc; i += 2) {
+        std::string option = argv[i];
+        if (i + 1 >= argc) {
+            return usage(argv[0]);
+        }
+        if (option == "--expect-state") {
+            expectedState = parseGameState(argv[i + 1]);
+            if (!expectedState) return usage(argv[0]);
+        } else if (option == "--expect-winner") {
+            expectedWinner = parseWinner(argv[i + 1]);
+            if (!expectedWinner) return usage(argv[0]);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+
+    try {
+        std::vector<RecordedEvent> events = loadEventLog(argv[1]);
+        Game game{false};
+        auto start = std::chrono::steady_clock::now();
+        game.replay(events);
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << "Replayed " << events.size() << " events in " << elapsed.count() << " us" << std::endl;
+        std::cout << "Final state: " << gameStateName(game.getGameState())
+                  << ", winner: " << winnerName(game.getWinner()) << std::endl;
+
+        bool passed = true;
+        if (expectedState && *expectedState != game.getGameState()) {
+            std::cerr << "Expected state " << gameStateName(*expectedState) << std::endl;
+            passed = false;
+        }
+        if (expectedWinner && *expectedWinner != game.getWinner()) {
+            std::cerr << "Expected winner " << winnerName(*expectedWinner) << std::endl;
+            passed = false;
+        }
+        return passed ? 0 : 1;
+    } catch (const std::runtime_error &e) {
+        std::cerr << "Failed to replay: " << e.what() << std::endl;
+        return 2;
+    }
+}
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "CommandLine.h"
+#include "ThumbnailRenderer.h"
+
+namespace {
+    int usage(const char *program) {
+        std::cerr << "Usage: " << program << " <boards-file> <output-dir> [--size <pixels>] [--atlas-size <pixels>]"
+                  << " [--threads <count>] [--atlas]" << std::endl
+                  << "Each line of the boards file holds one board in row-major order, e.g. XO..X...O" << std::endl;
+        return 2;
+    }
+
+    std::vector<Board> loadBoards(const std::string &path) {
+        std::ifstream in(path);
+        if (!in) {
+            throw std::runtime_error("Error loading boards: Cannot open " + path + ".");
+        }
+        std::vector<Board> boards;
+        std::string line;
+        for (int lineNumber = 1; std::getline(in, line); ++lineNumber) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (line.empty()) {
+                continue;
+            }
+            std::optional<Board> board = parseBoard(line);
+            if (!board) {
+                throw std::runtime_error("Error loading boards: Invalid board on line " + std::to_string(lineNumber) + ".");
+            }
+            boards.push_back(*board);
+        }
+        return boards;
+    }
+}// namespace
+
+/* Renders a thumbnail for every board of an archive into PNG files, without opening a window. */
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        return usage(argv[0]);
+    }
+    unsigned size = 64;
+    unsigned atlasSize = 2048;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    bool atlasOnly = false;
+    for (int i = 3; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--atlas") {
+            atlasOnly = true;
+        } else if (i + 1 < argc && option == "--size") {
+            size = parseNumber(argv[++i]).value_or(0);
+        } else if (i + 1 < argc && option == "--atlas-size") {
+            atlasSize = parseNumber(argv[++i]).value_or(0);
+        } else if (i + 1 < argc && option == "--threads") {
+            threads = parseNumber(argv[++i]).value_or(0);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+
+    if (size == 0 || atlasSize == 0 || threads == 0) {
+        return usage(argv[0]);
+    }
+
+    try {
+        std::vector<Board> boards = loadBoards(argv[1]);
+        std::filesystem::create_directories(argv[2]);
+        auto start = std::chrono::steady_clock::now();
+
+        ThumbnailRenderer renderer(size, atlasSize);
+        std::size_t pages = renderer.render(boards, argv[2], threads, atlasOnly);
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "Rendered and saved " << boards.size() << " boards on " << pages << " atlas pages in "
+                  << elapsed.count() << " ms" << std::endl;
+    } catch (const std::exception &e) {
+        std::cerr << "Failed to render thumbnails: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
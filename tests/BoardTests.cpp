@@ -0,0 +1,56 @@
+#include "../src/Board.h"
+#include "../src/BoardRenderer.h"
+#include <gtest/gtest.h>
+
+TEST(BoardTests, parseBoard) {
+    std::optional<Board> board = parseBoard("XO.-X ..O");
+    ASSERT_TRUE(board.has_value());
+    ASSERT_EQ((*board)[ROW_1][COL_1], Mark::X);
+    ASSERT_EQ((*board)[ROW_1][COL_2], Mark::O);
+    ASSERT_EQ((*board)[ROW_1][COL_3], Mark::EMPTY);
+    ASSERT_EQ((*board)[ROW_2][COL_1], Mark::EMPTY);
+    ASSERT_EQ((*board)[ROW_2][COL_2], Mark::X);
+    ASSERT_EQ((*board)[ROW_2][COL_3], Mark::EMPTY);
+    ASSERT_EQ((*board)[ROW_3][COL_3], Mark::O);
+}
+
+TEST(BoardTests, parseBoardRejectsInvalidText) {
+    ASSERT_FALSE(parseBoard("XO..X...").has_value());
+    ASSERT_FALSE(parseBoard("XO..X...O.").has_value());
+    ASSERT_FALSE(parseBoard("XO..Z...O").has_value());
+}
+
+TEST(BoardTests, appendBoardBatchesGridAndMarks) {
+    BoardRenderer renderer;
+    sf::VertexArray empty(sf::Triangles);
+    renderer.appendBoard(empty, *parseBoard("........."), sf::Transform::Identity);
+    ASSERT_EQ(empty.getVertexCount(), 4 * 6); /* four grid lines of two triangles */
+
+    sf::VertexArray oneX(sf::Triangles);
+    renderer.appendBoard(oneX, *parseBoard("X........"), sf::Transform::Identity);
+    ASSERT_EQ(oneX.getVertexCount(), empty.getVertexCount() + 2 * 6); /* two bars of two triangles */
+
+    sf::VertexArray oneBoard(sf::Triangles);
+    renderer.appendBoard(oneBoard, *parseBoard("XO......."), sf::Transform::Identity);
+    sf::VertexArray twoBoards(sf::Triangles);
+    renderer.appendBoard(twoBoards, *parseBoard("XO......."), sf::Transform::Identity);
+    renderer.appendBoard(twoBoards, *parseBoard("XO......."), sf::Transform::Identity);
+    ASSERT_EQ(twoBoards.getVertexCount(), 2 * oneBoard.getVertexCount());
+}
+
+TEST(BoardTests, appendBoardAppliesTransform) {
+    BoardRenderer renderer;
+    sf::VertexArray original(sf::Triangles);
+    renderer.appendBoard(original, *parseBoard("XO......."), sf::Transform::Identity);
+    sf::Transform transform;
+    transform.translate(64.f, 128.f);
+    transform.scale(0.5f, 0.5f);
+    sf::VertexArray moved(sf::Triangles);
+    renderer.appendBoard(moved, *parseBoard("XO......."), transform);
+
+    ASSERT_EQ(moved.getVertexCount(), original.getVertexCount());
+    for (std::size_t i = 0; i < original.getVertexCount(); ++i) {
+        ASSERT_FLOAT_EQ(moved[i].position.x, 64.f + original[i].position.x / 2);
+        ASSERT_FLOAT_EQ(moved[i].position.y, 128.f + original[i].position.y / 2);
+    }
+}
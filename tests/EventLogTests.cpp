@@ -0,0 +1,44 @@
+#include "../src/EventLog.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+
+TEST(EventLogTests, recordAndLoadRoundTrip) {
+    std::string path = (std::filesystem::temp_directory_path() / "noughts_event_log_test.bin").string();
+    {
+        EventRecorder recorder(path);
+        sf::Event click{};
+        click.type = sf::Event::MouseButtonPressed;
+        click.mouseButton = {sf::Mouse::Left, 310, -4};
+        recorder.record(click);
+        sf::Event resize{};
+        resize.type = sf::Event::Resized;
+        resize.size = {1024, 768};
+        recorder.record(resize);
+        sf::Event closed{};
+        closed.type = sf::Event::Closed;
+        recorder.record(closed);
+    }
+    std::vector<RecordedEvent> events = loadEventLog(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(events.size(), 3);
+    ASSERT_EQ(events[0].event.type, sf::Event::MouseButtonPressed);
+    ASSERT_EQ(events[0].event.mouseButton.button, sf::Mouse::Left);
+    ASSERT_EQ(events[0].event.mouseButton.x, 310);
+    ASSERT_EQ(events[0].event.mouseButton.y, -4);
+    ASSERT_EQ(events[1].event.type, sf::Event::Resized);
+    ASSERT_EQ(events[1].event.size.width, 1024);
+    ASSERT_EQ(events[1].event.size.height, 768);
+    ASSERT_EQ(events[2].event.type, sf::Event::Closed);
+    ASSERT_LE(events[0].timestamp, events[2].timestamp);
+}
+
+TEST(EventLogTests, loadRejectsInvalidFile) {
+    std::string path = (std::filesystem::temp_directory_path() / "noughts_event_log_invalid.bin").string();
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "not an event log";
+    }
+    ASSERT_THROW(loadEventLog(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
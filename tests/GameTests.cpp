@@ -71,3 +71,55 @@ TEST_F(GameTests, checkWinConditionOWinDiagonalTopRightToBottomLeft) {
     setBoard(boardTest);
     ASSERT_EQ(getCheckWinCondition(), Winner::O);
 }
+
+TEST_F(GameTests, replayXWinsTopRow) {
+    setGameState(GameState::PLAYING);
+    /* X: top row, O: middle row */
+    game.replay({leftClick(50, 50), leftClick(50, 250),
+                 leftClick(250, 50), leftClick(250, 250),
+                 leftClick(450, 50)});
+    ASSERT_EQ(game.getGameState(), GameState::GAME_OVER);
+    ASSERT_EQ(game.getWinner(), Winner::X);
+}
+
+TEST_F(GameTests, replayIgnoresOccupiedAndOutOfBoardClicks) {
+    setGameState(GameState::PLAYING);
+    game.replay({leftClick(50, 50), leftClick(60, 60), leftClick(-300, 50), leftClick(650, 50)});
+    ASSERT_EQ(game.getTurnNumber(), 1);
+    ASSERT_EQ(game.getIsXTurn(), false);
+    ASSERT_EQ(game.getGameState(), GameState::PLAYING);
+}
+
+TEST_F(GameTests, replayClickAfterResize) {
+    setGameState(GameState::PLAYING);
+    RecordedEvent resize{};
+    resize.event.type = sf::Event::Resized;
+    resize.event.size = {1200, 600};
+    /* The board is centered: the first column now starts at x = 300 */
+    game.replay({resize, leftClick(250, 50), leftClick(350, 50)});
+    ASSERT_EQ(game.getTurnNumber(), 1);
+    ASSERT_EQ(game.getIsXTurn(), false);
+}
+
+TEST_F(GameTests, recordingStartsWithWindowSize) {
+    RecordedEvent resize{};
+    resize.event.type = sf::Event::Resized;
+    resize.event.size = {900, 600};
+    game.replay({resize});
+    std::string path = (std::filesystem::temp_directory_path() / "noughts_window_size_test.bin").string();
+    game.startRecording(path);
+    std::vector<RecordedEvent> events = loadEventLog(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(events.size(), 1);
+    ASSERT_EQ(events[0].event.type, sf::Event::Resized);
+    ASSERT_EQ(events[0].event.size.width, 900);
+    ASSERT_EQ(events[0].event.size.height, 600);
+
+    /* The board now starts at x = 150; without the recorded size the click would land in the first column */
+    Game replayed{false};
+    setGameState(replayed, GameState::PLAYING);
+    events.push_back(leftClick(100, 50));
+    replayed.replay(events);
+    ASSERT_EQ(replayed.getTurnNumber(), 0);
+}
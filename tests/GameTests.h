@@ -2,6 +2,7 @@
 #define NOUGHTS_AND_CROSSES_GAMETESTS_H
 
 #include "../src/Game.h"
+#include <filesystem>
 #include <gtest/gtest.h>
 
 class GameTests : public ::testing::Test {
@@ -22,6 +23,21 @@ protected:
     void setBoard(std::array<std::array<Mark, numRows>, numColumns> b) {
         game.board = b;
     }
+
+    void setGameState(GameState state) {
+        game.gameState = state;
+    }
+
+    static void setGameState(Game &other, GameState state) {
+        other.gameState = state;
+    }
+
+    static RecordedEvent leftClick(int x, int y) {
+        RecordedEvent recorded{};
+        recorded.event.type = sf::Event::MouseButtonPressed;
+        recorded.event.mouseButton = {sf::Mouse::Left, x, y};
+        return recorded;
+    }
 };
 
 #endif//NOUGHTS_AND_CROSSES_GAMETESTS_H
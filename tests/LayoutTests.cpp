@@ -0,0 +1,34 @@
+#include "../src/Layout.h"
+#include <gtest/gtest.h>
+
+TEST(LayoutTests, defaultWindowMapsClicksToCells) {
+    Layout layout(sf::Vector2u(DEFAULT_WINDOW_SIZE, DEFAULT_WINDOW_SIZE));
+    ASSERT_FLOAT_EQ(layout.getCellSize(), CELL_SIZE);
+    ASSERT_EQ(layout.cellAt(sf::Vector2i(0, 0)), sf::Vector2i(COL_1, ROW_1));
+    ASSERT_EQ(layout.cellAt(sf::Vector2i(250, 450)), sf::Vector2i(COL_2, ROW_3));
+    ASSERT_EQ(layout.cellAt(sf::Vector2i(599, 599)), sf::Vector2i(COL_3, ROW_3));
+    ASSERT_FALSE(layout.cellAt(sf::Vector2i(600, 10)).has_value());
+    ASSERT_FALSE(layout.cellAt(sf::Vector2i(-1, 10)).has_value());
+}
+
+TEST(LayoutTests, wideWindowCentersBoard) {
+    Layout layout(sf::Vector2u(DEFAULT_WINDOW_SIZE, DEFAULT_WINDOW_SIZE));
+    layout.update(sf::Vector2u(3840, 2160));
+    ASSERT_FLOAT_EQ(layout.getCellSize(), 720.f);
+    ASSERT_FLOAT_EQ(layout.getScale(), 3.6f);
+    ASSERT_FLOAT_EQ(layout.getBoardOrigin().x, 840.f);
+    ASSERT_FLOAT_EQ(layout.getBoardOrigin().y, 0.f);
+    ASSERT_FALSE(layout.cellAt(sf::Vector2i(839, 100)).has_value());
+    ASSERT_EQ(layout.cellAt(sf::Vector2i(840, 100)), sf::Vector2i(COL_1, ROW_1));
+    ASSERT_EQ(layout.cellAt(sf::Vector2i(2999, 2159)), sf::Vector2i(COL_3, ROW_3));
+    ASSERT_EQ(layout.toWindow(sf::Vector2f(100.f, 200.f)), sf::Vector2f(1200.f, 720.f));
+    ASSERT_EQ(layout.scaleCharacterSize(30), 108);
+}
+
+TEST(LayoutTests, largerBoard) {
+    Layout layout(sf::Vector2u(1000, 700), 7, 5);
+    ASSERT_FLOAT_EQ(layout.getCellSize(), 100.f);
+    ASSERT_FLOAT_EQ(layout.getBoardOrigin().x, 250.f);
+    ASSERT_EQ(layout.cellAt(sf::Vector2i(749, 699)), sf::Vector2i(4, 6));
+    ASSERT_FALSE(layout.cellAt(sf::Vector2i(750, 10)).has_value());
+}
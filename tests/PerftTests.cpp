@@ -0,0 +1,33 @@
+#include "../src/Perft.h"
+#include <gtest/gtest.h>
+
+TEST(PerftTests, emptyBoardMatchesKnownTotals) {
+    Board board = *parseBoard(".........");
+    for (int depth = 0; depth <= MAX_TURNS; ++depth) {
+        ASSERT_EQ(perft(board, depth, 1, false).sequences, KNOWN_SEQUENCES[depth]);
+    }
+}
+
+TEST(PerftTests, threadsAndTranspositionsGiveSameCount) {
+    Board board = *parseBoard(".........");
+    PerftResult plain = perft(board, MAX_TURNS, 1, false);
+    PerftResult parallel = perft(board, MAX_TURNS, 4, false);
+    PerftResult hashed = perft(board, MAX_TURNS, 4, true);
+    ASSERT_EQ(plain.sequences, 255168);
+    ASSERT_EQ(parallel.sequences, plain.sequences);
+    ASSERT_EQ(parallel.nodes, plain.nodes);
+    ASSERT_EQ(hashed.sequences, plain.sequences);
+    ASSERT_LT(hashed.nodes, plain.nodes);
+}
+
+TEST(PerftTests, stopsAtTerminalPositions) {
+    ASSERT_EQ(perft(*parseBoard("XXXOO...."), MAX_TURNS, 2, false).sequences, 1);
+    /* O to move: after blocking the top right 5 * 4 sequences remain, otherwise X can win at once: 5 * (1 + 4 * 4) */
+    ASSERT_EQ(perft(*parseBoard("XX.O....."), 3, 1, false).sequences, 5 * 4 + 5 * (1 + 4 * 4));
+}
+
+TEST(PerftTests, reportsThreadsUsed) {
+    ASSERT_EQ(perft(*parseBoard("........."), 3, 16, false).threads, 9);
+    ASSERT_EQ(perft(*parseBoard("XX.O....."), 3, 2, false).threads, 2);
+    ASSERT_EQ(perft(*parseBoard("XXXOO...."), 3, 8, false).threads, 1);
+}
@@ -0,0 +1,71 @@
+#include "../src/ThumbnailRenderer.h"
+#include <SFML/Graphics/Image.hpp>
+#include <gtest/gtest.h>
+#include <filesystem>
+
+namespace {
+    std::size_t countFiles(const std::filesystem::path &directory, const std::string &prefix) {
+        std::size_t count = 0;
+        for (const auto &entry: std::filesystem::directory_iterator(directory)) {
+            if (entry.path().filename().string().starts_with(prefix)) {
+                ++count;
+            }
+        }
+        return count;
+    }
+}// namespace
+
+class ThumbnailRendererTests : public ::testing::Test {
+protected:
+    std::filesystem::path directory;
+    /* The first board is empty so the grid and background can be sampled */
+    std::vector<Board> boards{*parseBoard("........."), *parseBoard("X........"), *parseBoard("XO......."),
+                              *parseBoard("XOX......"), *parseBoard("XOXO....."), *parseBoard("XOXOX...."),
+                              *parseBoard("XOXOXO..."), *parseBoard("XOXOXOX.."), *parseBoard("XXXOO....")};
+
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() / "noughts_thumbnail_test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+};
+
+TEST(ThumbnailRendererSlotTests, atlasSlotArea) {
+    ASSERT_EQ(atlasSlotArea(0, 32, 64), sf::IntRect(0, 0, 64, 64));
+    ASSERT_EQ(atlasSlotArea(1, 32, 64), sf::IntRect(64, 0, 64, 64));
+    ASSERT_EQ(atlasSlotArea(31, 32, 64), sf::IntRect(31 * 64, 0, 64, 64));
+    ASSERT_EQ(atlasSlotArea(32, 32, 64), sf::IntRect(0, 64, 64, 64));
+    ASSERT_EQ(atlasSlotArea(32 * 32 - 1, 32, 64), sf::IntRect(31 * 64, 31 * 64, 64, 64));
+    ASSERT_EQ(atlasSlotArea(4, 3, 100), sf::IntRect(100, 100, 100, 100));
+}
+
+TEST_F(ThumbnailRendererTests, renderThumbnailsOverSeveralPages) {
+    /* Two by two boards per page: more pages than MAX_PAGES_IN_FLIGHT */
+    ThumbnailRenderer renderer(120, 240);
+    ASSERT_EQ(renderer.render(boards, directory.string(), 2, false), 3);
+    ASSERT_EQ(countFiles(directory, "board_"), boards.size());
+    ASSERT_EQ(countFiles(directory, "atlas_"), 0);
+
+    sf::Image thumbnail;
+    ASSERT_TRUE(thumbnail.loadFromFile((directory / "board_000000.png").string()));
+    ASSERT_EQ(thumbnail.getSize(), sf::Vector2u(120, 120));
+    /* At a scale of 0.2 the first vertical grid line covers x = 39 to 41 */
+    ASSERT_EQ(thumbnail.getPixel(39, 60), sf::Color(47, 79, 79));
+    ASSERT_EQ(thumbnail.getPixel(10, 10), sf::Color(18, 18, 18));
+}
+
+TEST_F(ThumbnailRendererTests, renderAtlases) {
+    ThumbnailRenderer renderer(120, 240);
+    ASSERT_EQ(renderer.render(boards, directory.string(), 2, true), 3);
+    ASSERT_EQ(countFiles(directory, "atlas_"), 3);
+    ASSERT_EQ(countFiles(directory, "board_"), 0);
+}
+
+TEST_F(ThumbnailRendererTests, renderFailsForUnwritableDirectory) {
+    ThumbnailRenderer renderer(120, 240);
+    ASSERT_THROW(renderer.render(boards, (directory / "missing").string(), 2, false), std::runtime_error);
+}